@@ -0,0 +1,40 @@
+#!/bin/sh
+
+# Finds the fastest flex table layout of cool.flex for a corpus.
+# Usage: ./flex-tables-bench.sh [FILE...]    (default: generated 16M inputs)
+#        RUNS=5 ./flex-tables-bench.sh       (best of RUNS runs, default 3)
+
+CXXFLAGS="-O2 -Wall -Isrc/ -Iobj/ -Wno-unused -Wno-deprecated -Wno-write-strings -Wno-free-nonheap-object"
+COOLSRC=../semantic-analyzer/src
+FLEXSRC=../flex-lexer/src
+FLEX=${FLEX:-flex}
+RUNS=${RUNS:-3}
+TABLES="-Cem -Ce -Cm -C -Cfe -CFe -Cf -CF"
+
+mkdir -p bin obj/inputs
+
+CORPUS="$*"
+if [ -z "$CORPUS" ]; then
+    g++ $CXXFLAGS src/gen-input.cpp -o bin/gen-input || exit 1
+    for kind in ident string comment numeric; do
+        input=obj/inputs/$kind-16M.cl
+        [ -f $input ] || bin/gen-input $kind 16M > $input
+        CORPUS="$CORPUS $input"
+    done
+fi
+
+for tables in $TABLES; do
+    $FLEX $tables -o obj/cool-flex-lexer$tables.cc $COOLSRC/cool.flex &&
+    g++ $CXXFLAGS -I$COOLSRC -I$FLEXSRC src/bench-cool-flex.cc obj/cool-flex-lexer$tables.cc \
+        $COOLSRC/stringtab.cc $COOLSRC/utilities.cc $COOLSRC/cool-tokens.cc -o bin/bench-cool-flex$tables || continue
+    for input in $CORPUS; do
+        printf "%-5s " $tables
+        bin/bench-cool-flex$tables $input $RUNS
+    done
+done | tee obj/flex-tables.txt
+
+# Total MB/s over the corpus for every layout, fastest last
+awk '{ bytes[$1] += $4; time[$1] += $4 / 1e6 / $6 }
+     END { for (t in bytes) printf "%-5s %9.2f MB/s\n", t, bytes[t] / 1e6 / time[t] }' obj/flex-tables.txt |
+    sort -k2 -n | tee obj/flex-tables-total.txt
+echo "# fastest: ./build.sh release $(tail -n 1 obj/flex-tables-total.txt | cut -d ' ' -f 1)"
@@ -0,0 +1,42 @@
+#!/bin/sh
+
+# Throughput of the lexers on synthetic inputs.
+# Usage: ./lexer-bench.sh [SIZE...]    (sizes like 1K, 1M, 100M)
+#        RUNS=5 ./lexer-bench.sh       (best of RUNS runs, default 3)
+
+CXXFLAGS="-O2 -Wall -Isrc/ -Iobj/ -Wno-unused -Wno-deprecated -Wno-write-strings -Wno-free-nonheap-object"
+COOLSRC=../semantic-analyzer/src
+FLEXSRC=../flex-lexer/src
+REGEXSRC=../regex/lexer-cxx
+FLEX=${FLEX:-flex}
+FLEXXX=${FLEXXX:-flex++}
+RUNS=${RUNS:-3}
+SIZES=${*:-"1K 1M 16M 100M"}
+
+mkdir -p bin obj/inputs
+rm -f bin/bench-*
+
+g++ $CXXFLAGS src/gen-input.cpp -o bin/gen-input || exit 1
+
+$FLEX -o obj/cool-flex-lexer.cc $COOLSRC/cool.flex &&
+g++ $CXXFLAGS -I$COOLSRC -I$FLEXSRC src/bench-cool-flex.cc obj/cool-flex-lexer.cc \
+    $COOLSRC/stringtab.cc $COOLSRC/utilities.cc $COOLSRC/cool-tokens.cc -o bin/bench-cool-flex
+
+g++ $CXXFLAGS -std=c++20 -I$COOLSRC -I$FLEXSRC src/bench-cool-dfa.cc \
+    $COOLSRC/stringtab.cc $COOLSRC/utilities.cc -o bin/bench-cool-dfa
+
+$FLEXXX -o obj/CoolLexer.cpp $FLEXSRC/CoolLexer.flex &&
+g++ $CXXFLAGS -I$FLEXSRC src/bench-coollexer.cpp obj/CoolLexer.cpp -o bin/bench-coollexer &&
+g++ $CXXFLAGS -I$FLEXSRC src/bench-coollexer-mem.cpp obj/CoolLexer.cpp -o bin/bench-coollexer-mem
+
+g++ $CXXFLAGS -I$REGEXSRC src/bench-regex.cpp -o bin/bench-regex
+
+for size in $SIZES; do
+    for kind in ident string comment prose numeric; do
+        input=obj/inputs/$kind-$size.cl
+        [ -f $input ] || bin/gen-input $kind $size > $input
+        for bench in bin/bench-cool-flex bin/bench-cool-dfa bin/bench-coollexer bin/bench-coollexer-mem bin/bench-regex; do
+            [ -x $bench ] && $bench $input $RUNS
+        done
+    done
+done